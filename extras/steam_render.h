@@ -0,0 +1,244 @@
+//=============================================================================
+//
+// NOT PART OF THE STEAMWORKS SDK.
+//
+// Thread-safe, allocation-free text rendering for CSteamID, CGameID and
+// servernetadr_t values.  The SDK's own servernetadr_t::Get*AddressString()
+// return pointers into shared static storage, and CSteamID::Render() /
+// CGameID::Render() are hidden functions implemented inside steamclient.
+// These helpers only use the public accessors of those types, so they work
+// with any steamworks_sdk_NNN directory on the include path.
+//
+// The SteamID3 rules below are this header's own.  They have not been
+// checked against steamclient's CSteamID::Render() and may not match it
+// for every account type.
+//
+//=============================================================================
+
+#ifndef STEAM_RENDER_H
+#define STEAM_RENDER_H
+
+#include "steamclientpublic.h"
+#include "matchmakingtypes.h"
+
+namespace SteamRender
+{
+
+// Exact buffer sizes for the longest possible output, including the '\0'
+enum
+{
+	k_cchMaxSteamID3 = 27,		// "[A:255:4294967295:1048575]"
+	k_cchMaxGameID = 21,		// "18446744073709551615"
+	k_cchMaxServerAddress = 22,	// "255.255.255.255:65535"
+};
+
+namespace detail
+{
+	//-----------------------------------------------------------------------------
+	// Purpose: Writes the decimal digits of ulValue into [pchFirst, pchLast), without
+	//			a terminator.  Returns one past the last character written, or NULL if
+	//			the digits do not fit.
+	//-----------------------------------------------------------------------------
+	inline char *RenderDecimalU64( uint64 ulValue, char *pchFirst, char *pchLast )
+	{
+		char rgchDigits[20];
+		int cchDigits = 0;
+		do
+		{
+			rgchDigits[cchDigits++] = (char)( '0' + ( ulValue % 10 ) );
+			ulValue /= 10;
+		} while ( ulValue != 0 );
+
+		if ( pchFirst == NULL || pchLast - pchFirst < cchDigits )
+			return NULL;
+
+		while ( cchDigits > 0 )
+			*pchFirst++ = rgchDigits[--cchDigits];
+		return pchFirst;
+	}
+
+	inline char *RenderChar( char ch, char *pchFirst, char *pchLast )
+	{
+		if ( pchFirst == NULL || pchFirst >= pchLast )
+			return NULL;
+		*pchFirst++ = ch;
+		return pchFirst;
+	}
+
+	//-----------------------------------------------------------------------------
+	// Purpose: Null-terminates the result of a range render into pchBuffer.  pchEnd is
+	//			the value the range render returned for [pchBuffer, pchBuffer + cchBuffer - 1).
+	//			Returns the number of characters written, not including the terminator;
+	//			on failure writes an empty string (if there is room) and returns 0.
+	//-----------------------------------------------------------------------------
+	inline int FinishRender( char *pchEnd, char *pchBuffer, int cchBuffer )
+	{
+		if ( pchBuffer == NULL || cchBuffer <= 0 )
+			return 0;
+		if ( pchEnd == NULL )
+		{
+			pchBuffer[0] = '\0';
+			return 0;
+		}
+		*pchEnd = '\0';
+		return (int)( pchEnd - pchBuffer );
+	}
+
+	inline char *BufferLast( char *pchBuffer, int cchBuffer )
+	{
+		// Leave room for the terminator
+		return ( pchBuffer != NULL && cchBuffer > 0 ) ? pchBuffer + ( cchBuffer - 1 ) : pchBuffer;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Renders a steam ID in SteamID3 form, e.g. "[U:1:123]", into
+//			[pchFirst, pchLast) in the style of std::to_chars.  No terminator is
+//			written.  Returns one past the last character written, or NULL if the
+//			text does not fit (the range contents are then unspecified).
+//
+//			Type letters: I U M G A P C g T a, with chat IDs rendered as 'c' when
+//			the clan flag is set, else 'L' when the lobby flag is set.  The instance
+//			is appended for M and A, and for U when it is not the desktop instance.
+//			Account types with no letter (e.g. console users) are rendered as the
+//			decimal 64-bit value.
+//-----------------------------------------------------------------------------
+inline char *RenderSteamID3( const CSteamID &steamID, char *pchFirst, char *pchLast )
+{
+	uint32 unInstance = steamID.GetUnAccountInstance();
+	bool bWithInstance = false;
+
+	char chType;
+	switch ( steamID.GetEAccountType() )
+	{
+	case k_EAccountTypeInvalid:			chType = 'I'; break;
+	case k_EAccountTypeIndividual:		chType = 'U'; bWithInstance = ( unInstance != 1 ); break;	// 1 is the desktop instance
+	case k_EAccountTypeMultiseat:		chType = 'M'; bWithInstance = true; break;
+	case k_EAccountTypeGameServer:		chType = 'G'; break;
+	case k_EAccountTypeAnonGameServer:	chType = 'A'; bWithInstance = true; break;
+	case k_EAccountTypePending:			chType = 'P'; break;
+	case k_EAccountTypeContentServer:	chType = 'C'; break;
+	case k_EAccountTypeClan:			chType = 'g'; break;
+	case k_EAccountTypeAnonUser:		chType = 'a'; break;
+	case k_EAccountTypeChat:
+		if ( unInstance & k_EChatInstanceFlagClan )
+			chType = 'c';
+		else if ( unInstance & k_EChatInstanceFlagLobby )
+			chType = 'L';
+		else
+			chType = 'T';
+		break;
+	default:
+		return detail::RenderDecimalU64( steamID.ConvertToUint64(), pchFirst, pchLast );
+	}
+
+	char *pch = detail::RenderChar( '[', pchFirst, pchLast );
+	pch = detail::RenderChar( chType, pch, pchLast );
+	pch = detail::RenderChar( ':', pch, pchLast );
+	pch = detail::RenderDecimalU64( (uint64)steamID.GetEUniverse(), pch, pchLast );
+	pch = detail::RenderChar( ':', pch, pchLast );
+	pch = detail::RenderDecimalU64( steamID.GetAccountID(), pch, pchLast );
+	if ( bWithInstance )
+	{
+		pch = detail::RenderChar( ':', pch, pchLast );
+		pch = detail::RenderDecimalU64( unInstance, pch, pchLast );
+	}
+	return detail::RenderChar( ']', pch, pchLast );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Renders a game ID as its decimal 64-bit value into [pchFirst, pchLast).
+//			Same contract as the range form of RenderSteamID3.
+//-----------------------------------------------------------------------------
+inline char *RenderGameID( const CGameID &gameID, char *pchFirst, char *pchLast )
+{
+	return detail::RenderDecimalU64( gameID.ToUint64(), pchFirst, pchLast );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Renders 'a.b.c.d:port' into [pchFirst, pchLast).  unIP is in host byte
+//			order, as returned by servernetadr_t::GetIP().  Same contract as the
+//			range form of RenderSteamID3.
+//-----------------------------------------------------------------------------
+inline char *RenderServerAddress( uint32 unIP, uint16 usPort, char *pchFirst, char *pchLast )
+{
+	char *pch = pchFirst;
+	for ( int nShift = 24; nShift >= 0; nShift -= 8 )
+	{
+		pch = detail::RenderDecimalU64( ( unIP >> nShift ) & 0xFF, pch, pchLast );
+		pch = detail::RenderChar( ( nShift > 0 ) ? '.' : ':', pch, pchLast );
+	}
+	return detail::RenderDecimalU64( usPort, pch, pchLast );
+}
+
+inline char *RenderConnectionAddress( const servernetadr_t &netadr, char *pchFirst, char *pchLast )
+{
+	return RenderServerAddress( netadr.GetIP(), netadr.GetConnectionPort(), pchFirst, pchLast );
+}
+
+inline char *RenderQueryAddress( const servernetadr_t &netadr, char *pchFirst, char *pchLast )
+{
+	return RenderServerAddress( netadr.GetIP(), netadr.GetQueryPort(), pchFirst, pchLast );
+}
+
+//-----------------------------------------------------------------------------
+// Null-terminated forms of the above.  Return the number of characters written,
+// not including the terminator, or 0 (with pchBuffer set to "" when it has room)
+// if the text does not fit.  Use the k_cchMax* sizes to always succeed.
+//-----------------------------------------------------------------------------
+inline int RenderSteamID3( const CSteamID &steamID, char *pchBuffer, int cchBuffer )
+{
+	return detail::FinishRender( RenderSteamID3( steamID, pchBuffer, detail::BufferLast( pchBuffer, cchBuffer ) ), pchBuffer, cchBuffer );
+}
+
+inline int RenderGameID( const CGameID &gameID, char *pchBuffer, int cchBuffer )
+{
+	return detail::FinishRender( RenderGameID( gameID, pchBuffer, detail::BufferLast( pchBuffer, cchBuffer ) ), pchBuffer, cchBuffer );
+}
+
+inline int RenderConnectionAddress( const servernetadr_t &netadr, char *pchBuffer, int cchBuffer )
+{
+	return detail::FinishRender( RenderConnectionAddress( netadr, pchBuffer, detail::BufferLast( pchBuffer, cchBuffer ) ), pchBuffer, cchBuffer );
+}
+
+inline int RenderQueryAddress( const servernetadr_t &netadr, char *pchBuffer, int cchBuffer )
+{
+	return detail::FinishRender( RenderQueryAddress( netadr, pchBuffer, detail::BufferLast( pchBuffer, cchBuffer ) ), pchBuffer, cchBuffer );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Bulk forms.  Render nCount values into one contiguous, null-terminated
+//			buffer, separated by chSeparator (e.g. '\n').  Returns the number of
+//			characters written, not including the terminator, or 0 (with pchBuffer
+//			set to "" when it has room) if the whole list does not fit.  A buffer of
+//			nCount * k_cchMax* characters is always large enough.
+//-----------------------------------------------------------------------------
+inline int RenderSteamID3List( const CSteamID *pSteamIDs, int nCount, char chSeparator, char *pchBuffer, int cchBuffer )
+{
+	char *pchLast = detail::BufferLast( pchBuffer, cchBuffer );
+	char *pch = pchBuffer;
+	for ( int i = 0; i < nCount && pch != NULL; ++i )
+	{
+		if ( i > 0 )
+			pch = detail::RenderChar( chSeparator, pch, pchLast );
+		pch = RenderSteamID3( pSteamIDs[i], pch, pchLast );
+	}
+	return detail::FinishRender( pch, pchBuffer, cchBuffer );
+}
+
+inline int RenderConnectionAddressList( const servernetadr_t *pAddrs, int nCount, char chSeparator, char *pchBuffer, int cchBuffer )
+{
+	char *pchLast = detail::BufferLast( pchBuffer, cchBuffer );
+	char *pch = pchBuffer;
+	for ( int i = 0; i < nCount && pch != NULL; ++i )
+	{
+		if ( i > 0 )
+			pch = detail::RenderChar( chSeparator, pch, pchLast );
+		pch = RenderConnectionAddress( pAddrs[i], pch, pchLast );
+	}
+	return detail::FinishRender( pch, pchBuffer, cchBuffer );
+}
+
+} // namespace SteamRender
+
+#endif // STEAM_RENDER_H